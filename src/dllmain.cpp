@@ -42,10 +42,19 @@ float fHUDHeight;
 float fHUDWidthOffset;
 float fHUDHeightOffset;
 
+// UI resize targets, indexed from the smallest width/height that gets resized
+constexpr short iUIMinWidth = 1920;
+constexpr short iUIMaxWidth = 2048;
+constexpr short iUIMinHeight = 1080;
+constexpr short iUIMaxHeight = 1200;
+std::array<short, iUIMaxHeight - iUIMinHeight + 1> UIWidthForHeight;
+std::array<short, iUIMaxWidth - iUIMinWidth + 1> UIHeightForWidth;
+short iLetterboxWidth = 1920;
+short iLetterboxHeight = 256;
+
 // Variables
 float fRenderScale = 1.0f;
 DWORD64 RenderScaleAddress;
-bool bIsMoviePlaying = false;
 DWORD64 MoviePlaybackAddress;
 HMODULE baseModule = GetModuleHandle(NULL);
 
@@ -161,6 +170,32 @@ void ReadConfig()
         fHUDHeightOffset = (float)(iCustomResY - fHUDHeight) / 2;
     }
 
+    // Precalculate UI resize targets so the UI hook doesn't redo them per object
+    for (short i = 0; i < (short)UIWidthForHeight.size(); i++)
+    {
+        short iHeight = iUIMinHeight + i;
+        UIWidthForHeight[i] = (fAspectRatio > fNativeAspect) ? static_cast<short>(iHeight * fAspectRatio) : iUIMinWidth;
+    }
+    for (short i = 0; i < (short)UIHeightForWidth.size(); i++)
+    {
+        short iWidth = iUIMinWidth + i;
+        UIHeightForWidth[i] = (fAspectRatio < fNativeAspect) ? static_cast<short>(iWidth / fAspectRatio) : iUIMinHeight;
+    }
+    if (fAspectRatio > fNativeAspect)
+    {
+        iLetterboxWidth = static_cast<short>(1920 * fAspectMultiplier);
+    }
+    else if (fAspectRatio < fNativeAspect)
+    {
+        // This is dumb, just flipping the texture. Maybe just disable letterboxing at <16:9?
+        iLetterboxHeight = static_cast<short>(-256 - fHUDHeightOffset);
+    }
+    if (bDisableLetterboxing)
+    {
+        iLetterboxWidth = (short)0;
+        iLetterboxHeight = (short)0;
+    }
+
     // Log aspect ratio stuff
     spdlog::info("Custom Resolution: fAspectRatio: {}", fAspectRatio);
     spdlog::info("Custom Resolution: fAspectMultiplier: {}", fAspectMultiplier);
@@ -407,68 +442,56 @@ void UIFix()
                     if (ctx.rax)
                     {
                         // Get starting values
-                        std::string sObjectName = (std::string)(char*)(ctx.rax + 0x280);
                         short iWidth = *reinterpret_cast<short*>(ctx.rax + 0xF0);
                         short iHeight = *reinterpret_cast<short*>(ctx.rax + 0xF2);
                         int iMarker = *reinterpret_cast<int*>(ctx.rax + 0x4C);
-                        if (MoviePlaybackAddress)
-                        {
-                            bIsMoviePlaying = *reinterpret_cast<int*>(MoviePlaybackAddress);
-                        }
 
-                        // Find movie playback layer and add marker so it remains unmodified.
-                        if (iWidth == (short)1920 && iHeight == (short)1080 && sObjectName.contains("parts_blank") && iMarker == 0 && bIsMoviePlaying)
+                        // Check for marker so we don't edit the same thing twice.
+                        if (iMarker == 420)
                         {
-                            // Add marker
-                            iMarker = 420;
-                            spdlog::info("UI Width: Fixed FMV playback.");
+                            return;
                         }
 
-                        // Check for marker so we don't edit the same thing twice.
-                        if (iMarker != 420)
+                        // Find movie playback layer and add marker so it remains unmodified.
+                        if (iWidth == (short)1920 && iHeight == (short)1080 && iMarker == 0)
                         {
-                            // Resize all UI elements that are 1920-2048x1080-1200
-                            if ((iWidth >= (short)1920 && iWidth <= (short)2048) && (iHeight >= (short)1080 && iHeight <= (short)1200))
+                            bool bIsMoviePlaying = false;
+                            if (MoviePlaybackAddress)
                             {
-                                if (fAspectRatio > fNativeAspect)
-                                {
-                                    iWidth = static_cast<short>(iHeight * fAspectRatio);
-                                }
-                                else if (fAspectRatio < fNativeAspect)
-                                {
-                                    iHeight = static_cast<short>(iWidth / fAspectRatio);
-                                }
-                                // Add marker
-                                iMarker = 420;
+                                bIsMoviePlaying = *reinterpret_cast<int*>(MoviePlaybackAddress);
                             }
 
-                            // Cutscene letterboxing
-                            if (iWidth == (short)1920 && iHeight == (short)256)
+                            if (bIsMoviePlaying && std::string_view((char*)(ctx.rax + 0x280)).contains("parts_blank"))
                             {
-                                if (fAspectRatio > fNativeAspect)
-                                {
-                                    iWidth = static_cast<short>(1920 * fAspectMultiplier);
-                                }
-                                else if (fAspectRatio < fNativeAspect)
-                                {
-                                    // This is dumb, just flipping the texture. Maybe just disable letterboxing at <16:9?
-                                    iHeight = static_cast<short>(-256 - fHUDHeightOffset);
-                                }
-
-                                if (bDisableLetterboxing)
-                                {
-                                    iWidth = (short)0;
-                                    iHeight = (short)0;
-                                }
                                 // Add marker
-                                iMarker = 420;
+                                *reinterpret_cast<short*>(ctx.rax + 0x4C) = (short)420;
+                                spdlog::info("UI Width: Fixed FMV playback.");
+                                return;
                             }
                         }
 
-                        // Write modified values
-                        *reinterpret_cast<short*>(ctx.rax + 0xF0) = iWidth;
-                        *reinterpret_cast<short*>(ctx.rax + 0xF2) = iHeight;
-                        *reinterpret_cast<short*>(ctx.rax + 0x4C) = iMarker;
+                        // Resize all UI elements that are 1920-2048x1080-1200
+                        if ((iWidth >= iUIMinWidth && iWidth <= iUIMaxWidth) && (iHeight >= iUIMinHeight && iHeight <= iUIMaxHeight))
+                        {
+                            if (fAspectRatio > fNativeAspect)
+                            {
+                                *reinterpret_cast<short*>(ctx.rax + 0xF0) = UIWidthForHeight[iHeight - iUIMinHeight];
+                            }
+                            else if (fAspectRatio < fNativeAspect)
+                            {
+                                *reinterpret_cast<short*>(ctx.rax + 0xF2) = UIHeightForWidth[iWidth - iUIMinWidth];
+                            }
+                            // Add marker
+                            *reinterpret_cast<short*>(ctx.rax + 0x4C) = (short)420;
+                        }
+                        // Cutscene letterboxing
+                        else if (iWidth == (short)1920 && iHeight == (short)256)
+                        {
+                            *reinterpret_cast<short*>(ctx.rax + 0xF0) = iLetterboxWidth;
+                            *reinterpret_cast<short*>(ctx.rax + 0xF2) = iLetterboxHeight;
+                            // Add marker
+                            *reinterpret_cast<short*>(ctx.rax + 0x4C) = (short)420;
+                        }
                     }
                 });
         }
@@ -68,16 +68,42 @@ namespace Memory
         auto s = patternBytes.size();
         auto d = patternBytes.data();
 
-        for (auto i = 0ul; i < sizeOfImage - s; ++i) {
+        // Anchor on the first fixed byte, preferring a non-zero one since zero runs are everywhere.
+        size_t anchor = s;
+        for (size_t j = 0; j < s; ++j) {
+            if (d[j] == -1)
+                continue;
+            if (anchor == s)
+                anchor = j;
+            if (d[j] != 0) {
+                anchor = j;
+                break;
+            }
+        }
+
+        if (sizeOfImage <= s)
+            return nullptr;
+        if (anchor == s)
+            return scanBytes;
+
+        auto anchorByte = (std::uint8_t)d[anchor];
+        auto last = scanBytes + (sizeOfImage - s - 1);
+        for (auto p = scanBytes; p <= last; ++p) {
+            // Jump straight to the next occurrence of the anchor byte
+            p = (std::uint8_t*)memchr(p + anchor, anchorByte, (last - p) + 1);
+            if (!p)
+                break;
+            p -= anchor;
+
             bool found = true;
             for (auto j = 0ul; j < s; ++j) {
-                if (scanBytes[i + j] != d[j] && d[j] != -1) {
+                if (p[j] != d[j] && d[j] != -1) {
                     found = false;
                     break;
                 }
             }
             if (found) {
-                return &scanBytes[i];
+                return p;
             }
         }
         return nullptr;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <sstream>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <filesystem>
 #include <Windows.h>
\ No newline at end of file
@@ -0,0 +1,355 @@
+// sigcheck - offline signature validation for P5StrikersFix
+// Memory-maps dumped game executables and reports how every signature used by
+// src/dllmain.cpp resolves, so a game update can be checked without launching it.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Keep in sync with the scans in src/dllmain.cpp.
+struct PatchOffset
+{
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct Signature
+{
+    const char* name;
+    const char* pattern;
+    std::vector<PatchOffset> offsets;
+};
+
+static const std::vector<Signature> Signatures = {
+    { "UI Aspect Ratio", "41 ?? 80 07 00 00 44 ?? ?? ?? ?? 41 ?? 38 04 00 00", { { 0x2, 4 }, { 0xD, 4 } } },
+    { "Custom Resolution", "89 ?? ?? ?? 00 00 48 ?? ?? ?? ?? ?? ?? 83 ?? ?? 77 ?? 8B ?? ?? ?? ?? ?? ?? EB ?? B9 D0 02 00 00", { { 0x0, 5 }, { 0x27, 5 } } },
+    { "Custom Resolution: Fullscreen", "80 ?? ?? ?? ?? ?? 00 0F ?? ?? ?? ?? ?? 8B ?? ?? ?? ?? ?? 0F ?? ?? F3 0F ?? ?? ?? ?? ?? ?? 0F ?? ??", { { 0x6, 1 } } },
+    { "Custom Resolution: Borderless", "80 ?? ?? ?? ?? ?? 00 74 ?? 80 ?? ?? ?? ?? ?? 00 74 ?? 4C ?? ?? ?? ?? ?? ?? 48 ?? ?? ?? ?? ?? ??", { { 0x7, 1 } } },
+    { "Render Scale", "00 00 00 00 66 0F ?? ?? ?? ?? ?? ?? 0F ?? ?? F3 0F ?? ?? ?? ?? ?? ?? C3", { { 0x8, 4 } } },
+    { "Render Target Resolution 1", "41 ?? ?? 89 ?? ?? ?? 89 ?? ?? ?? 48 ?? ?? E8 ?? ?? ?? ??", { { 0x0, 5 } } },
+    { "Render Target Resolution 2", "41 ?? ?? 49 ?? ?? ?? 44 ?? ?? 89 ?? ?? ?? 89 ?? ?? ?? 44 ?? ?? ?? ??", { { 0x0, 5 } } },
+    { "UI Cursor Position 1", "0F ?? ?? F3 0F ?? ?? F3 0F ?? ?? 0F ?? ?? 76 ?? 0F ?? ?? F3 0F ?? ?? F3 0F ?? ?? F3 0F ?? ?? 0F ?? ??", { { 0x0, 5 } } },
+    { "UI Cursor Position 2", "F3 0F ?? ?? 66 0F ?? ?? F3 0F ?? ?? 66 0F ?? ?? ?? ?? 0F ?? ?? F3 0F ?? ?? F3 0F ?? ?? 29 ?? ?? ??", { { 0x0, 5 } } },
+    { "Markers 1", "C7 ?? ?? 38 04 00 00 41 ?? 80 07 00 00 4C ?? ?? ??", { { 0x3, 4 }, { 0x9, 4 } } },
+    { "Markers 2", "41 ?? 80 07 00 00 C7 ?? ?? ?? 38 04 00 00 33 ??", { { 0x2, 4 }, { 0xA, 4 } } },
+    { "Movie Playback", "83 ?? ?? ?? ?? ?? FF 75 ?? 48 ?? ?? ?? ?? ?? ?? 48 ?? ?? FF ?? ?? ?? ?? ??", { { 0xC, 4 } } },
+    { "UI Width", "8B ?? ?? ?? ?? 00 89 ?? ?? 49 ?? ?? ?? 48 ?? ?? FF ?? ?? ?? ?? 00", { { 0x0, 5 } } },
+    { "Cutscene FOV", "F3 0F ?? ?? ?? ?? ?? ?? F3 0F ?? ?? F3 0F ?? ?? ?? ?? ?? ?? E8 ?? ?? ?? ?? F3 0F ?? ?? ?? ?? 48 8D ?? ?? ?? F3 0F ?? ?? ?? ?? ?? ??", { { 0xC, 5 } } },
+    { "Gameplay FOV", "E8 ?? ?? ?? ?? F3 0F ?? ?? ?? ?? ?? 00 41 ?? 01 F3 0F ?? ?? ?? ?? ?? ?? 41 ?? ?? ?? 48 ?? ??", { { 0xD, 5 } } },
+    { "Intro Skip", "C7 ?? ?? 04 00 00 00 48 ?? ?? ?? ?? 48 ?? ?? ?? 5F E9 ?? ?? ?? ?? 41 ?? 01", { { 0x3, 4 } } },
+    { "Shadow Quality 1", "00 10 00 00 00 10 00 00 4E 00 00 00 00 04 00 00", { { 0x0, 4 }, { 0x4, 4 } } },
+    { "Shadow Quality 2", "BA 00 10 00 00 44 ?? ?? EB ?? BA 00 08 00 00", { { 0x1, 4 } } },
+    { "Analog Movement Fix: XInputGetState", "F3 0F ?? ?? ?? ?? ?? ?? 8D ?? ?? 83 ?? 07 77 ?? 48 ?? ?? ?? ?? 8B ?? E8 ?? ?? ?? ??", { { 0x0, 8 } } },
+};
+
+// Same pattern syntax as Memory::PatternScan, -1 is a wildcard.
+static std::vector<int> PatternToBytes(const char* pattern)
+{
+    auto bytes = std::vector<int>{};
+    auto start = const_cast<char*>(pattern);
+    auto end = const_cast<char*>(pattern) + strlen(pattern);
+
+    for (auto current = start; current < end; ++current) {
+        if (*current == '?') {
+            ++current;
+            if (*current == '?')
+                ++current;
+            bytes.push_back(-1);
+        }
+        else {
+            bytes.push_back(strtoul(current, &current, 16));
+        }
+    }
+    return bytes;
+}
+
+// A file-backed range of the image, scanned in place inside the mapping.
+struct Section
+{
+    uint32_t rva;
+    const uint8_t* data;
+    size_t size;
+};
+
+struct Image
+{
+    std::string path;
+    const uint8_t* base = nullptr;
+    size_t size = 0;
+    uint32_t timestamp = 0;
+    std::vector<Section> sections;
+    std::string error;
+
+    // Returns a pointer into the mapping for an RVA, or nullptr if fewer than length bytes are file-backed there.
+    const uint8_t* AtRVA(uint64_t rva, size_t length) const
+    {
+        for (const auto& section : sections) {
+            if (rva >= section.rva && rva + length <= (uint64_t)section.rva + section.size)
+                return section.data + (rva - section.rva);
+        }
+        return nullptr;
+    }
+};
+
+template<typename T>
+static bool ReadAt(const Image& image, size_t offset, T& out)
+{
+    if (offset + sizeof(T) > image.size)
+        return false;
+    memcpy(&out, image.base + offset, sizeof(T));
+    return true;
+}
+
+// Maps the file read-only and applies the PE section mapping.
+static bool LoadImage(Image& image)
+{
+    int fd = open(image.path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        image.error = strerror(errno);
+        return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        image.error = "empty or unreadable file";
+        close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        image.error = strerror(errno);
+        return false;
+    }
+    madvise(mapping, (size_t)st.st_size, MADV_WILLNEED);
+
+    image.base = (const uint8_t*)mapping;
+    image.size = (size_t)st.st_size;
+
+    // IMAGE_DOS_HEADER / IMAGE_NT_HEADERS fields, read by offset so 32-bit and 64-bit images both work.
+    uint16_t mz = 0;
+    uint32_t lfanew = 0;
+    uint32_t signature = 0;
+    if (!ReadAt(image, 0, mz) || mz != 0x5A4D || !ReadAt(image, 0x3C, lfanew) || !ReadAt(image, lfanew, signature) || signature != 0x4550) {
+        image.error = "not a PE image";
+        return false;
+    }
+
+    uint16_t numberOfSections = 0;
+    uint16_t sizeOfOptionalHeader = 0;
+    uint32_t sizeOfHeaders = 0;
+    size_t fileHeader = lfanew + 4;
+    size_t optionalHeader = fileHeader + 20;
+    ReadAt(image, fileHeader + 2, numberOfSections);
+    ReadAt(image, fileHeader + 4, image.timestamp);
+    ReadAt(image, fileHeader + 16, sizeOfOptionalHeader);
+    ReadAt(image, optionalHeader + 60, sizeOfHeaders);
+
+    image.sections.push_back({ 0, image.base, std::min<size_t>(sizeOfHeaders, image.size) });
+
+    size_t sectionHeader = optionalHeader + sizeOfOptionalHeader;
+    for (uint16_t i = 0; i < numberOfSections; ++i, sectionHeader += 40) {
+        uint32_t virtualSize = 0;
+        uint32_t virtualAddress = 0;
+        uint32_t sizeOfRawData = 0;
+        uint32_t pointerToRawData = 0;
+        if (!ReadAt(image, sectionHeader + 8, virtualSize) || !ReadAt(image, sectionHeader + 12, virtualAddress) ||
+            !ReadAt(image, sectionHeader + 16, sizeOfRawData) || !ReadAt(image, sectionHeader + 20, pointerToRawData)) {
+            image.error = "truncated section table";
+            return false;
+        }
+
+        if (pointerToRawData >= image.size || sizeOfRawData == 0)
+            continue;
+        size_t size = std::min<size_t>(sizeOfRawData, image.size - pointerToRawData);
+        if (virtualSize)
+            size = std::min<size_t>(size, virtualSize);
+        image.sections.push_back({ virtualAddress, image.base + pointerToRawData, size });
+    }
+    return true;
+}
+
+struct Result
+{
+    size_t matches = 0;
+    uint32_t firstRVA = 0;
+};
+
+// Counts every match of a pattern across the image's sections, anchored with memchr like Memory::PatternScan.
+static Result ScanImage(const Image& image, const std::vector<int>& patternBytes)
+{
+    Result result;
+    auto s = patternBytes.size();
+    auto d = patternBytes.data();
+
+    size_t anchor = s;
+    for (size_t j = 0; j < s; ++j) {
+        if (d[j] == -1)
+            continue;
+        if (anchor == s)
+            anchor = j;
+        if (d[j] != 0) {
+            anchor = j;
+            break;
+        }
+    }
+    if (anchor == s)
+        return result;
+
+    auto anchorByte = (uint8_t)d[anchor];
+    for (const auto& section : image.sections) {
+        if (section.size < s)
+            continue;
+
+        auto begin = section.data;
+        auto last = begin + (section.size - s);
+        for (auto p = begin; p <= last; ++p) {
+            p = (const uint8_t*)memchr(p + anchor, anchorByte, (last - p) + 1);
+            if (!p)
+                break;
+            p -= anchor;
+
+            bool found = true;
+            for (size_t j = 0; j < s; ++j) {
+                if (p[j] != d[j] && d[j] != -1) {
+                    found = false;
+                    break;
+                }
+            }
+            if (found) {
+                if (result.matches == 0)
+                    result.firstRVA = section.rva + (uint32_t)(p - begin);
+                result.matches++;
+            }
+        }
+    }
+    return result;
+}
+
+static void CollectImages(const std::filesystem::path& path, std::vector<Image>& images)
+{
+    std::error_code ec;
+    if (std::filesystem::is_directory(path, ec)) {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+            auto extension = entry.path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+            if (entry.is_regular_file(ec) && extension == ".exe")
+                files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+        for (const auto& file : files)
+            images.push_back({ file.string() });
+    }
+    else {
+        images.push_back({ path.string() });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <game exe or folder of builds>...\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<Image> images;
+    for (int i = 1; i < argc; ++i)
+        CollectImages(argv[i], images);
+
+    std::vector<std::vector<int>> patterns;
+    for (const auto& signature : Signatures)
+        patterns.push_back(PatternToBytes(signature.pattern));
+
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    // Map every image in parallel, then scan each (image, signature) pair on the same pool.
+    std::atomic<size_t> next{ 0 };
+    auto runJobs = [&](size_t jobCount, auto&& job) {
+        next = 0;
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < std::min<size_t>(threadCount, jobCount); ++t) {
+            workers.emplace_back([&] {
+                for (size_t i = next++; i < jobCount; i = next++)
+                    job(i);
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+    };
+
+    runJobs(images.size(), [&](size_t i) { LoadImage(images[i]); });
+
+    std::vector<Result> results(images.size() * Signatures.size());
+    runJobs(results.size(), [&](size_t i) {
+        const auto& image = images[i / Signatures.size()];
+        if (image.error.empty())
+            results[i] = ScanImage(image, patterns[i % Signatures.size()]);
+    });
+
+    int failures = 0;
+    for (size_t i = 0; i < images.size(); ++i) {
+        const auto& image = images[i];
+        if (!image.error.empty()) {
+            printf("%s: %s\n\n", image.path.c_str(), image.error.c_str());
+            failures++;
+            continue;
+        }
+
+        printf("%s (timestamp %u)\n", image.path.c_str(), image.timestamp);
+        for (size_t j = 0; j < Signatures.size(); ++j) {
+            const auto& signature = Signatures[j];
+            const auto& result = results[i * Signatures.size() + j];
+
+            if (result.matches == 0) {
+                printf("  %-12s%s\n", "[MISSING]", signature.name);
+                failures++;
+                continue;
+            }
+
+            // The DLL takes the first match, so ambiguous signatures show that one.
+            char status[32];
+            if (result.matches == 1) {
+                snprintf(status, sizeof(status), "[OK]");
+            }
+            else {
+                snprintf(status, sizeof(status), "[AMBIG x%zu]", result.matches);
+                failures++;
+            }
+            printf("  %-12s%-36s rva=0x%08x", status, signature.name, result.firstRVA);
+
+            for (const auto& patch : signature.offsets) {
+                printf("  +0x%x:", patch.offset);
+                const uint8_t* bytes = image.AtRVA((uint64_t)result.firstRVA + patch.offset, patch.length);
+                if (!bytes) {
+                    printf(" ??");
+                    continue;
+                }
+                for (uint32_t k = 0; k < patch.length; ++k)
+                    printf(" %02X", bytes[k]);
+            }
+            printf("\n");
+        }
+        printf("\n");
+    }
+
+    for (auto& image : images) {
+        if (image.base)
+            munmap((void*)image.base, image.size);
+    }
+    return failures ? 1 : 0;
+}